@@ -8,6 +8,7 @@
 //            4. Difficulty selection: easy, medium, hard.
 //            5. Simulator added! One time AI vs AI is not cool?
 //               Try simulatror now! Run up to 4000 times of AI vs AI games with different depths and check out the result.
+//            6. Tournament! Round robin between AI setups (depth, time budget, search radius, evaluation) with Elo and speed.
 //  What's New in 1.0:
 //      Enhanced AI VS AI mode, run up to 4000 simulations and get results of win/loss ratio between two different AI depths (smartness).
 //      Dynamic display of input range.
@@ -22,6 +23,9 @@
 #include <iostream>
 #include <vector>
 #include <cmath>
+#include <string>
+#include <iomanip>
+#include <chrono>
 using namespace std;
 //  Universal Constants
 const int ROW = 3;              // Dimensions of the gameboard
@@ -30,12 +34,46 @@ const int TURN = ROW * COL;     // Most turn possible.
 const int winCondition = 3;     // Winning conidtion, can be set to any number of connected markers.
 const int X = -1;               // define X as -1 and O as 1
 const int O = 1;
+const int maxCloseRadius = 2;   // Largest radius getCloseMoves() has neighbor tables for.
 //  Depths for AI player, number size determines how "smart" it is.
 int minDepth = 2;
 int midDepth = 4;
 int maxDepth = 8;
 int bestMove = 0;   // Best move for the next step.
 int boardMarker[ROW][COL];  // 2D array of game status, also controls the board display.
+//  A spot on the board by row and column, so tables never need the (position - 1) / ROW math at search time.
+struct Cell {
+    int row;
+    int col;
+};
+int closeRadius = 1;        // How far getCloseMoves() looks around existing markers, 1 - maxCloseRadius. Set it with setCloseRadius().
+vector<Cell> neighborTable[maxCloseRadius][TURN];   // Precomputed neighbors of each cell, see buildNeighborTable().
+vector<const int *> lineTable;  // Every line of winCondition spots on the board, back to back, pointing into boardMarker. See buildLineTable().
+bool lineEval = false;      // If true, score() also rewards open lines instead of only win/loss.
+long long nodeCount = 0;    // Number of positions Adam has visited, used by the tournament to measure speed.
+bool useDeadline = false;   // If true, Adam gives up once searchDeadline has passed and sets searchAborted.
+bool searchAborted = false;
+chrono::steady_clock::time_point searchDeadline;
+
+//  One AI setup in the tournament.
+struct Engine {
+    string name;
+    int depth;          // Max search depth.
+    int timeBudget;     // Microseconds per move, searched deeper one depth at a time until it runs out. 0 means no limit.
+    int radius;         // closeRadius used while this engine thinks.
+    bool lineEval;      // Evaluation variant, see lineEval above.
+};
+//  Match records of one engine in the tournament.
+struct EngineRecord {
+    int wins;
+    int draws;
+    int losses;
+    double scoreSquares;    // Sum of squared game scores (1, 0.5, 0), needed for the confidence interval.
+    int moves;
+    int cutMoves;           // Moves where the time budget stopped the search.
+    double totalMs;
+    long long nodes;
+};
 
 void gameMenu (int & gameMode, bool & humanFirst, int & diffculty);  //  Display game menu, as for game mode.
 void gameStart (int gameMode, bool humanTurn, int gameDifficulty);    //  Game start, run the game based on game mode selection.
@@ -67,14 +105,25 @@ char askRestart();  //  Ask the user if wish to restart the game.
 void setSimulator (int & maxTime, int & depthOne, int & depthTwo);  // Configuration of simulator, including times and depths.
 void runSimulator ();   //  Run simulator.
 
+/************************** Tournament  *******************************/
+void setTournament (int & rounds, unsigned & seed);     // Configuration of tournament, number of openings and seed.
+void buildRoster (vector<Engine> &engines);             // AI setups taking part in the tournament.
+int engineMove (const Engine &engine, int currentPlayer, EngineRecord &record);    // Let an engine pick a move, with timing.
+int playMatch (const Engine &xEngine, const Engine &oEngine, const vector<int> &opening, EngineRecord &xRecord, EngineRecord &oRecord);
+void runTournament ();  //  Run round robin tournament and print Elo table.
+
 /*************************  RNG HINT  **************************************/
 int RNG ();     //  Random number generator on avalible moves.
 
 /*************************  AI HINT  **************************************/
 void getMoves (vector<int> &availableMoves);    //  Gets all available moves on the board.
+void buildNeighborTable ();                      //  Precompute neighbors of every position, once per board size.
+void buildLineTable ();                          //  Precompute every possible winning line, once per board size.
+void setCloseRadius (int radius);               //  Set closeRadius, kept within the range of the neighbor tables.
 void getCloseMoves (vector<int> &closeMoves);   //  Get moves only around existing markers.
 void revokeTurn (int position);                 //  Undo the turn to restore the chessboard.
 int score (int currentPlayer);                  //  Evalutating future moves.
+int lineScore ();                               //  Count open lines on the board, positive is good for O.
 int Adam (int currentPlayer, int depth, int difficulty);    //  Adam, AI player, negamax algorithm implemented.
 
 /****************************  FUNCTION ENDS **********************************/
@@ -86,8 +135,8 @@ void gameMenu (int & gameMode, bool & humanFirst, int & diffculty) {
     cout << "Welcome to Tic-Tac-Toe!\nUse number 1 - " <<  TURN << " to input marks, press 0 for hint.\n\n";
     resetBoard();   //  Reset board status
     printBoard();   //  Print board
-    while ((gameMode != 1 && gameMode != 2 && gameMode != 3) || badInput) {
-        cout << "Choose game mode:\n  [1] AI VS AI\n  [2] Player VS AI\n  [3] AI VS AI Simulation\n";
+    while ((gameMode != 1 && gameMode != 2 && gameMode != 3 && gameMode != 4) || badInput) {
+        cout << "Choose game mode:\n  [1] AI VS AI\n  [2] Player VS AI\n  [3] AI VS AI Simulation\n  [4] AI Tournament\n";
         gameMode = numberInput();   //  Game mode selection.
     }
     switch (gameMode) {             //  Only if the game mode is 2, let player to choose markers.
@@ -183,10 +232,14 @@ void gameStart (int gameMode, bool humanTurn, int gameDifficulty) {
                 runSimulator();
                 isEnd = true;
                 break;
+            case 4:                 //  Run tournament.
+                runTournament();
+                isEnd = true;
+                break;
             default:
                 break;
         }
-        if (gameMode != 3) {        //  Only print the result as following when the mode is not simulator (code: 3)
+        if (gameMode != 3 && gameMode != 4) {   //  Only print the result as following when the mode is not simulator (code: 3) or tournament (code: 4)
             switch (isOver()) {
                 case 0:
                     cout << "X-O DRAW!\n\n";
@@ -354,6 +407,207 @@ void runSimulator () {
     << " -- X O Draw " << draw << " games." << endl;
 }
 
+//  This function will setup the tournament, how many random openings each pair plays and the seed of the openings.
+void setTournament (int & rounds, unsigned & seed) {
+    int roundUpperBound = 200;
+    if (ROW >= 4) {
+        roundUpperBound /= 4;       //  Bigger board, much slower games.
+    }
+    cout << "Set number of openings (each pair plays both sides of every opening): ";
+    rounds = numberInput();
+    while (rounds <= 0 || rounds > roundUpperBound) {
+        cout << "Please enter a number between 1 to " << roundUpperBound << ": ";
+        rounds = numberInput();
+    }
+    cout << "Set opening seed (0 for random): ";
+    int input = numberInput();
+    while (input < 0) {
+        cout << "Seed can not be negative: ";
+        input = numberInput();
+    }
+    seed = (input == 0) ? unsigned(time(NULL)) : unsigned(input);
+}
+
+void buildRoster (vector<Engine> &engines) {
+    int depthUpperBound = maxDepth;
+    int timeBudget = 100;           //  Full depth "Hard" takes about 0.2 ms a move on 3*3, so 100 us really cuts the search.
+    if (ROW >= 4) {
+        depthUpperBound = midDepth; //  Same limit as the simulator to save the CPU.
+        timeBudget = 2000;          //  About what "Medium" spends on 5*5, with no depth cap the budget always decides.
+    }
+    Engine roster[] = {
+        //  name            depth             us          radius lineEval
+        {"Easy",            minDepth,         0,          1,     false},
+        {"Medium",          midDepth,         0,          1,     false},
+        {"Medium R2",       midDepth,         0,          2,     false},
+        {"Medium Lines",    midDepth,         0,          1,     true},
+        {"Hard",            depthUpperBound,  0,          1,     false},
+        {"Timed",           TURN,             timeBudget, 1,     false},   //  No depth cap, only the clock stops it.
+    };
+    for (size_t i = 0; i < sizeof(roster) / sizeof(roster[0]); i ++) {
+        bool duplicate = false;     //  On big boards "Hard" is capped to "Medium", don't let it play itself.
+        for (size_t j = 0; j < engines.size(); j ++) {
+            if (engines[j].depth == roster[i].depth && engines[j].timeBudget == roster[i].timeBudget
+                && engines[j].radius == roster[i].radius && engines[j].lineEval == roster[i].lineEval)
+                duplicate = true;
+        }
+        if (!duplicate)
+            engines.push_back(roster[i]);
+    }
+}
+
+int engineMove (const Engine &engine, int currentPlayer, EngineRecord &record) {
+    setCloseRadius(engine.radius);  //  Switch search and evaluation variants to this engine.
+    lineEval = engine.lineEval;
+    long long startNodes = nodeCount;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    int move = 0;
+    //  Without a time budget, search straight to the max depth.
+    //  With one, search depth 1, 2, 3... until Adam runs past the deadline, then drop that unfinished depth
+    //  and keep the move of the last finished one. Depth 1 always finishes so there is a move to play.
+    //  Once a depth reaches the number of empty spots it has searched to the end of the game, deeper is the same search.
+    vector<int> emptySpots;
+    getMoves(emptySpots);
+    int depthLimit = min(engine.depth, int(emptySpots.size()));
+    searchDeadline = start + chrono::microseconds(engine.timeBudget);
+    searchAborted = false;
+    for (int depth = (engine.timeBudget > 0) ? 1 : depthLimit; depth <= depthLimit; depth ++) {
+        useDeadline = (engine.timeBudget > 0 && depth > 1);
+        Adam(currentPlayer, depth, depth);
+        if (searchAborted) {
+            record.cutMoves ++;
+            break;
+        }
+        move = bestMove;
+    }
+    useDeadline = false;
+    double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    record.moves ++;
+    record.totalMs += elapsed;
+    record.nodes += nodeCount - startNodes;
+    return move;
+}
+
+//  Play one game from the given opening, return the result code of isOver().
+int playMatch (const Engine &xEngine, const Engine &oEngine, const vector<int> &opening, EngineRecord &xRecord, EngineRecord &oRecord) {
+    int currentPlayer = X;
+    resetBoard();
+    for (size_t i = 0; i < opening.size(); i ++) {     //  Replay the opening, X goes first.
+        play(opening[i], currentPlayer);
+        currentPlayer = -currentPlayer;
+    }
+    while (isOver() == 2) {
+        if (currentPlayer == X) {
+            play(engineMove(xEngine, X, xRecord), X);
+        } else {
+            play(engineMove(oEngine, O, oRecord), O);
+        }
+        currentPlayer = -currentPlayer;     //  Switch side.
+    }
+    return isOver();
+}
+
+void runTournament () {
+    vector<Engine> engines;
+    int rounds = 0;
+    unsigned seed = 0;
+    buildRoster(engines);
+    setTournament(rounds, seed);
+
+    int n = engines.size();
+    vector<EngineRecord> records(n, EngineRecord());
+    int savedRadius = closeRadius;
+    bool savedLineEval = lineEval;
+    int totalGames = rounds * n * (n - 1);
+    int gamesPlayed = 0;
+
+    for (int round = 0; round < rounds; round ++) {
+        //  Seeded random opening of 1 or 2 moves, every pair plays it from both sides.
+        srand(seed + round);
+        vector<int> opening;
+        int openingLength = 1 + rand() % 2;
+        resetBoard();
+        for (int i = 0; i < openingLength; i ++) {
+            int move = RNG();
+            play(move, (i % 2 == 0) ? X : O);
+            opening.push_back(move);
+        }
+        for (int a = 0; a < n; a ++) {
+            for (int b = 0; b < n; b ++) {
+                if (a == b)
+                    continue;
+                int result = playMatch(engines[a], engines[b], opening, records[a], records[b]);
+                switch (result) {       //  engines[a] plays X, engines[b] plays O.
+                    case X:
+                        records[a].wins ++;
+                        records[a].scoreSquares += 1;
+                        records[b].losses ++;
+                        break;
+                    case O:
+                        records[b].wins ++;
+                        records[b].scoreSquares += 1;
+                        records[a].losses ++;
+                        break;
+                    default:
+                        records[a].draws ++;
+                        records[a].scoreSquares += 0.25;
+                        records[b].draws ++;
+                        records[b].scoreSquares += 0.25;
+                        break;
+                }
+                gamesPlayed ++;
+                if (totalGames >= 10 && gamesPlayed % (totalGames / 10) == 0)
+                    cout << gamesPlayed * 100 / totalGames << "% Complete." << " (" << gamesPlayed << "/" << totalGames << ")" << endl;
+            }
+        }
+    }
+    setCloseRadius(savedRadius);    //  Put back the settings used by the other game modes.
+    lineEval = savedLineEval;
+    srand(time(NULL));
+
+    //  Elo from score percentage p against the field: 400 * log10(p / (1 - p)).
+    //  In a round robin everyone meets the same opponents, so the rating against the average of the others
+    //  is scaled by (n - 1) / n to put the average of the whole field at 0.
+    //  The 95% interval comes from the standard error of the game scores, carried through the slope of the Elo curve,
+    //  and gets the same (n - 1) / n scale as the rating.
+    //  Every engine is counted with one extra win and one extra loss, the "add two" adjustment of the Agresti-Coull
+    //  interval. Without it 100% or 0% gives an infinite rating, and an engine that drew every game gets a zero-width
+    //  interval even though a few games say little. The pull towards 50% shrinks as 1 / games.
+    vector<double> elo(n, 0);
+    vector<double> margin(n, 0);
+    double eloSum = 0;
+    double scale = double(n - 1) / n;
+    for (int i = 0; i < n; i ++) {
+        int games = records[i].wins + records[i].draws + records[i].losses + 2;
+        double p = (records[i].wins + 1 + 0.5 * records[i].draws) / games;
+        double variance = (records[i].scoreSquares + 1) / games - p * p;
+        double slope = 400 / (log(10.0) * p * (1 - p));
+        elo[i] = 400 * log10(p / (1 - p)) * scale;
+        margin[i] = 1.96 * sqrt(variance / games) * slope * scale;
+        eloSum += elo[i];
+    }
+
+    cout << "\nTournament is over! (" << ROW << "x" << COL << " board, " << totalGames << " games, seed " << seed << ")\n\n";
+    cout << left << setw(16) << "Engine" << right
+    << setw(7) << "Depth" << setw(7) << "us" << setw(8) << "Radius" << setw(7) << "Lines"
+    << setw(6) << "Win" << setw(6) << "Draw" << setw(6) << "Loss"
+    << setw(8) << "Elo" << setw(8) << "+/-" << setw(10) << "ms/move" << setw(12) << "nodes/move" << setw(6) << "Cut%" << endl;
+    cout << fixed;
+    for (int i = 0; i < n; i ++) {
+        int moves = max(records[i].moves, 1);
+        cout << left << setw(16) << engines[i].name << right
+        << setw(7) << engines[i].depth << setw(7) << engines[i].timeBudget << setw(8) << engines[i].radius
+        << setw(7) << (engines[i].lineEval ? "yes" : "no")
+        << setw(6) << records[i].wins << setw(6) << records[i].draws << setw(6) << records[i].losses
+        << setw(8) << setprecision(0) << elo[i] - eloSum / n << setw(8) << margin[i]
+        << setw(10) << setprecision(3) << records[i].totalMs / moves
+        << setw(12) << setprecision(0) << double(records[i].nodes) / moves
+        << setw(6) << 100.0 * records[i].cutMoves / moves << endl;
+    }
+    cout.unsetf(ios::fixed);
+    cout << setprecision(6) << endl;
+}
+
 bool predictDraw (int humanMark) {
     vector<int> availableMoves;
     getMoves(availableMoves);                                           //  First, get all available moves on the board.
@@ -547,60 +801,67 @@ void getMoves (vector<int> &availableMoves) {
         } else {}
     }
 }
-//  Get all available moves around existing markers only.
-void getCloseMoves (vector<int> &closeMoves) {
-    for (int i = 1; i <= TURN; i ++) {
-        int row = (i - 1) / ROW;
-        int col = (i - 1) % COL;
-        
-        //* NOTE *  Assume position around i is like 1 - 9, i is in the middle with 5.
-        
-        if (!isOccupied(i)) {   // Check positions that are not occupied.
-            if (row == 0) {     // if the position is on the top edge,
-                
-                if (col == 0) { // if the position is also on the left edge
-                    if (isOccupied(i+1) || isOccupied(i + COL) || isOccupied(i + COL + 1)) {    // check spot 6 8 9 only.
-                        closeMoves.push_back(i);
-                    }
-                } else if (col == COL - 1) {    // if the position is on the right edge.
-                    if (isOccupied(i-1) || isOccupied(i + COL) ||isOccupied(i + COL - 1)) {     // check spot 4 7 8 only.
-                        closeMoves.push_back(i);
-                    }
-                } else {
-                    if (isOccupied(i+1) || isOccupied(i-1) || isOccupied(i + COL) || isOccupied(i + COL + 1) || isOccupied(i + COL - 1)) // check 4 6 7 8 9
-                        closeMoves.push_back(i);
+//  Build neighbor tables for every position on the board, run once at startup.
+//  neighborTable[r - 1][i] holds the cells within radius r of cell i (position i + 1), edges already clipped.
+void buildNeighborTable () {
+    for (int radius = 1; radius <= maxCloseRadius; radius ++) {
+        for (int i = 0; i < TURN; i ++) {
+            int row = i / COL;
+            int col = i % COL;
+            neighborTable[radius - 1][i].clear();
+            for (int r = row - radius; r <= row + radius; r ++) {
+                for (int c = col - radius; c <= col + radius; c ++) {
+                    if (r < 0 || r >= ROW || c < 0 || c >= COL || (r == row && c == col))
+                        continue;   // Skip spots off the board and the cell itself.
+                    Cell neighbor = {r, c};
+                    neighborTable[radius - 1][i].push_back(neighbor);
                 }
-                
-            } else if (row == ROW - 1) {    // positions on the bottom edge.
-                if (col == 0) {             // left edge
-                    if (isOccupied(i+1) || isOccupied(i - COL) || isOccupied(i - COL + 1)) {    // check 2 3 6
-                        closeMoves.push_back(i);
-                    }
-                } else if (col == COL - 1) {    // right edge.
-                    if (isOccupied(i-1) || isOccupied(i - COL) ||isOccupied(i - COL - 1)) {     // check 1 2 4
-                        closeMoves.push_back(i);
-                    }
-                } else {
-                    if (isOccupied(i+1) || isOccupied(i-1) || isOccupied(i-COL) || isOccupied(i - COL - 1) || isOccupied(i - COL + 1))
-                        closeMoves.push_back(i);    // check 1 2 3 4 6
+            }
+        }
+    }
+}
+//  Build the list of all winning lines, horizontal, vertical, "\" and "/", winCondition cells per line.
+void buildLineTable () {
+    int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    lineTable.clear();
+    for (int d = 0; d < 4; d ++) {
+        for (int row = 0; row < ROW; row ++) {
+            for (int col = 0; col < COL; col ++) {
+                int endRow = row + directions[d][0] * (winCondition - 1);
+                int endCol = col + directions[d][1] * (winCondition - 1);
+                if (endRow < 0 || endRow >= ROW || endCol < 0 || endCol >= COL)
+                    continue;       // Line runs off the board.
+                for (int i = 0; i < winCondition; i ++) {
+                    lineTable.push_back(&boardMarker[row + directions[d][0] * i][col + directions[d][1] * i]);
                 }
-                
-            } else {
-                if (col == 0) { // left edge only
-                    if (isOccupied(i+1) || isOccupied(i-COL) || isOccupied(i - COL - 1) ||isOccupied(i + COL) || isOccupied(i + COL - 1)) {
-                        closeMoves.push_back(i);        // check 2 3 6 8 9
-                    }
-                } else if (col == COL - 1) {    // right edge only.
-                    if (isOccupied(i-1) || isOccupied(i-COL) || isOccupied(i - COL - 1) || isOccupied(i + COL) || isOccupied(i + COL - 1)) {
-                        closeMoves.push_back(i);        // check 1 2 4 7 8
-                    }
-                } else {
-                    if (isOccupied(i+1) || isOccupied(i-1) || isOccupied(i-COL) || isOccupied(i - COL - 1) || isOccupied(i - COL + 1) || isOccupied(i + COL) || isOccupied(i + COL + 1) || isOccupied(i + COL - 1)) {
-                        closeMoves.push_back(i);    // check 1 2 3 4 6 7 8 9
-                    }
+            }
+        }
+    }
+}
+//  Radius below 1 or above maxCloseRadius has no table, clamp it into range.
+void setCloseRadius (int radius) {
+    if (radius < 1)
+        radius = 1;
+    else if (radius > maxCloseRadius)
+        radius = maxCloseRadius;
+    closeRadius = radius;
+}
+//  Get all available moves around existing markers only.
+void getCloseMoves (vector<int> &closeMoves) {
+    for (int row = 0; row < ROW; row ++) {
+        for (int col = 0; col < COL; col ++) {
+            if (boardMarker[row][col] != 0 && boardMarker[row][col] != 10 * ROW)
+                continue;                   // Only check positions that are not occupied.
+            int i = row * COL + col;        // Cell i is position i + 1.
+            const vector<Cell> &neighbors = neighborTable[closeRadius - 1][i];
+            for (size_t j = 0; j < neighbors.size(); j ++) {
+                int mark = boardMarker[neighbors[j].row][neighbors[j].col];
+                if (mark != 0 && mark != 10 * ROW) {    // Any marker nearby makes it a close move.
+                    closeMoves.push_back(i + 1);
+                    break;
                 }
             }
-        } else {}
+        }
     }
 }
 
@@ -624,13 +885,38 @@ int score (int currentPlayer) {             // Evalutation function
         return 10000 * currentPlayer;       // therefore, if the rival wins the game will turn out a negative number.
     } else if (findWinner() == X){
         return -10000 * currentPlayer;
+    } else if (lineEval) {                  // No winner yet, judge by the open lines each side has.
+        return lineScore() * currentPlayer;
     } else {
         return 0;
     }
 }
 
+int lineScore () {      // Every line of winCondition spots holding only one player's markers scores count^2 for that player.
+    int total = 0;
+    for (size_t line = 0; line < lineTable.size(); line += winCondition) {
+        int oCount = 0;
+        int xCount = 0;
+        for (int i = 0; i < winCondition; i ++) {
+            int mark = *lineTable[line + i];
+            oCount += (mark == O);  // Count without branching, marks on the board are too random to predict.
+            xCount += (mark == X);
+        }
+        if (xCount == 0)
+            total += oCount * oCount;
+        else if (oCount == 0)
+            total -= xCount * xCount;
+    }
+    return total;
+}
+
 int Adam (int currentPlayer, int depth, int difficulty) {
     int bestScore = -1000000;               // Initialize a low score of our customer/ the maximizing player.
+    nodeCount ++;
+    if (useDeadline && nodeCount % 256 == 0 && chrono::steady_clock::now() >= searchDeadline)
+        searchAborted = true;               // Out of time, checked every 256 nodes to keep the clock cheap.
+    if (searchAborted)
+        return 0;                           // The result is thrown away, just unwind.
     // The goal is to get the best move when the score is as high as possible.
     if (depth == 0 || isOver() != 2) {      // When the depth goes 0, or the game is over,
         return score(currentPlayer);        // return as a evaluation score.
@@ -646,6 +932,8 @@ int Adam (int currentPlayer, int depth, int difficulty) {
             //cout << newScore << "   " << bestScore << endl;
             futureSteps.pop_back();         // Delete the last item in the vector array.
             revokeTurn(move);               // revoke the simulated move to restore chessboard.
+            if (searchAborted)
+                return 0;
             // In each loop, we are searching for the biggest value of the negation of the othe player.
             if (newScore >= bestScore) {    // if the newscore is bigger than the best score,
                 bestScore = newScore;       // set the new score as the best score since the maximizing player need the move when the score is at its highest.
@@ -672,6 +960,8 @@ char askRestart() {
 
 int main() {
     srand(time(NULL));          //  generate seed to random different place.
+    buildNeighborTable();       //  Neighbors and lines only depend on the board size, build them once.
+    buildLineTable();
     bool humanFirst = true;
     char restart = 'y';
     while (restart == 'y' || restart == 'Y') {